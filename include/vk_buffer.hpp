@@ -4,7 +4,10 @@
 #include <vulkan/vulkan.h>
 #include <functional>
 
-void createBuffer(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize size, VkBuffer &buffer, VkDeviceMemory &bufferMemory);
+void createBuffer(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize size, VkBuffer &buffer, VkDeviceMemory &bufferMemory,
+                  bool enableDeviceAddress = false);
+void loadBufferDeviceAddressFunction(VkDevice device);
+VkDeviceAddress getBufferDeviceAddress(VkDevice device, VkBuffer buffer);
 void initializeBufferData(VkDevice device, VkDeviceMemory bufferMemory, uint32_t vectorSize, std::function<float(int)> initFunction);
 void readBufferData(VkDevice device, VkDeviceMemory bufferMemory, uint32_t vectorSize);
 
@@ -7,6 +7,14 @@ VkCommandPool createCommandPool(VkDevice device);
 VkCommandBuffer createCommandBuffer(VkDevice device, VkCommandPool commandPool);
 void recordCommandBuffer(VkCommandBuffer commandBuffer, VkPipeline pipeline, VkPipelineLayout pipelineLayout, 
                          VkDescriptorSet descriptorSet, uint32_t width, uint32_t height);
+void recordCommandBufferWithPushConstants(VkCommandBuffer commandBuffer, VkPipeline pipeline, VkPipelineLayout pipelineLayout,
+                                          const void *pushConstants, uint32_t pushConstantSize, uint32_t width, uint32_t height);
+void beginCommandBuffer(VkCommandBuffer commandBuffer);
+void endCommandBuffer(VkCommandBuffer commandBuffer);
+void recordDispatch(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout, VkDescriptorSet descriptorSet,
+                    uint32_t width, uint32_t height);
+void recordDispatchWithPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout,
+                                     const void *pushConstants, uint32_t pushConstantSize, uint32_t width, uint32_t height);
 void submitCommandBuffer(VkDevice device, VkCommandBuffer commandBuffer);
 
 #endif // VK_COMMAND_HPP
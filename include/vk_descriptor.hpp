@@ -3,7 +3,7 @@
 
 #include <vulkan/vulkan.h>
 
-VkDescriptorPool createDescriptorPool(VkDevice device);
+VkDescriptorPool createDescriptorPool(VkDevice device, uint32_t maxSets = 1);
 VkDescriptorSet createDescriptorSet(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorSetLayout descriptorSetLayout, VkBuffer bufferA, VkBuffer bufferB, VkBuffer bufferResult, VkDeviceSize bufferSize);
 
 #endif // VK_DESCRIPTOR_HPP
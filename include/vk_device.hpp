@@ -4,7 +4,10 @@
 #include <vulkan/vulkan.h>
 #include <vector>
 
-VkDevice createLogicalDevice(VkInstance instance, VkPhysicalDevice& physicalDevice, VkQueue& graphicsQueue);
+// When requestBufferDeviceAddress is set, VK_KHR_buffer_device_address is enabled if the device supports it.
+// bufferDeviceAddressEnabled reports the outcome so callers can fall back to descriptor sets.
+VkDevice createLogicalDevice(VkInstance instance, VkPhysicalDevice& physicalDevice, VkQueue& graphicsQueue,
+                             bool requestBufferDeviceAddress, bool& bufferDeviceAddressEnabled);
 void checkDeviceExtensions(VkPhysicalDevice device, const std::vector<const char*>& requiredExtensions);
 
 #endif // VK_DEVICE_HPP
@@ -5,7 +5,8 @@
 #include <vector>
 #include <string>
 
-VkInstance createInstance();
+uint32_t getInstanceApiVersion();
+VkInstance createInstance(bool enableValidation = true);
 void checkInstanceExtensions(const std::vector<const char*>& requiredExtensions);
 
 #endif // VK_INSTANCE_HPP
@@ -4,9 +4,18 @@
 #include <vulkan/vulkan.h>
 #include <string>
 
+// Push constant block of kernels/vector_add_bda.comp
+struct VectorAddPushConstants {
+    VkDeviceAddress a;
+    VkDeviceAddress b;
+    VkDeviceAddress result;
+    uint32_t count;
+};
+
 VkShaderModule createShaderModule(VkDevice device, const std::string &filename);
 VkDescriptorSetLayout createDescriptorSetLayout(VkDevice device);
 VkPipelineLayout createPipelineLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout);
+VkPipelineLayout createPushConstantPipelineLayout(VkDevice device, uint32_t pushConstantSize);
 VkPipeline createComputePipeline(VkDevice device, VkShaderModule shaderModule, VkPipelineLayout pipelineLayout);
 
 #endif // VK_PIPELINE_HPP
@@ -7,9 +7,10 @@
 
 std::vector<char> readFile(const std::string& filename);
 std::vector<const char*> getInstanceExtensions();
-std::vector<const char*> getDeviceExtensions();
+std::vector<const char*> getDeviceExtensions(bool enableBufferDeviceAddress = false);
 void checkInstanceExtensions(const std::vector<const char*>& requiredExtensions);
 void checkDeviceExtensions(VkPhysicalDevice device, const std::vector<const char*>& requiredExtensions);
+bool isDeviceExtensionSupported(VkPhysicalDevice device, const char* extensionName);
 uint32_t findMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties);
 void cleanup(VkDevice device, VkInstance instance, VkPipeline pipeline, VkPipelineLayout pipelineLayout,	VkShaderModule computeShaderModule, VkDescriptorSetLayout descriptorSetLayout, VkDescriptorPool descriptorPool,	VkCommandPool commandPool, std::vector<VkBuffer> buffers, std::vector<VkDeviceMemory> bufferMemories);
 
@@ -0,0 +1,235 @@
+#include "vk_instance.hpp"
+#include "vk_device.hpp"
+#include "vk_buffer.hpp"
+#include "vk_pipeline.hpp"
+#include "vk_descriptor.hpp"
+#include "vk_command.hpp"
+#include "vk_utils.hpp"
+#include <chrono>
+#include <iostream>
+
+// Small vectors and many dispatches so that per-dispatch binding cost dominates
+const uint32_t VECTOR_SIZE = 1024;
+const uint32_t WORKGROUP_SIZE = 256;
+const uint32_t GROUP_COUNT = (VECTOR_SIZE + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+const uint32_t BUFFER_COUNT = 8;
+const uint32_t DISPATCHES_PER_ROUND = 4096;
+const uint32_t ROUNDS = 10;
+// Untimed rounds per mode that absorb first-use costs (pipeline warm-up, first pool allocations)
+const uint32_t WARMUP_ROUNDS = 1;
+
+struct BenchmarkResult {
+	double recordMs;
+	double totalMs;
+};
+
+// Dispatch i writes output i % BUFFER_COUNT, so only a full batch of BUFFER_COUNT dispatches
+// needs to finish before the outputs are reused; dispatches within a batch may overlap
+static bool endsOutputBatch(uint32_t dispatchIndex) {
+	return dispatchIndex % BUFFER_COUNT == BUFFER_COUNT - 1;
+}
+
+static void recordComputeBarrier(VkCommandBuffer commandBuffer) {
+	VkMemoryBarrier barrier = {};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+static double elapsedMs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Each dispatch binds a different buffer triple, which forces a fresh descriptor set per dispatch
+static BenchmarkResult runDescriptorMode(VkDevice device, VkCommandPool commandPool, VkCommandBuffer commandBuffer,
+	VkPipeline pipeline, VkPipelineLayout pipelineLayout, VkDescriptorSetLayout descriptorSetLayout,
+	VkDescriptorPool descriptorPool, const std::vector<VkBuffer>& inputs, const std::vector<VkBuffer>& outputs) {
+	BenchmarkResult result = {};
+	for (uint32_t round = 0; round < WARMUP_ROUNDS + ROUNDS; ++round) {
+		vkResetCommandPool(device, commandPool, 0);
+		vkResetDescriptorPool(device, descriptorPool, 0);
+
+		auto start = std::chrono::steady_clock::now();
+		beginCommandBuffer(commandBuffer);
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+		for (uint32_t i = 0; i < DISPATCHES_PER_ROUND; ++i) {
+			VkDescriptorSet descriptorSet = createDescriptorSet(device, descriptorPool, descriptorSetLayout,
+				inputs[i % BUFFER_COUNT], inputs[(i + 1) % BUFFER_COUNT], outputs[i % BUFFER_COUNT],
+				VECTOR_SIZE * sizeof(float));
+			recordDispatch(commandBuffer, pipelineLayout, descriptorSet, GROUP_COUNT, 1);
+			if (endsOutputBatch(i)) {
+				recordComputeBarrier(commandBuffer);
+			}
+		}
+		endCommandBuffer(commandBuffer);
+		auto recorded = std::chrono::steady_clock::now();
+
+		submitCommandBuffer(device, commandBuffer);
+		auto finished = std::chrono::steady_clock::now();
+
+		if (round < WARMUP_ROUNDS) {
+			continue;
+		}
+		result.recordMs += elapsedMs(start, recorded);
+		result.totalMs += elapsedMs(start, finished);
+	}
+	result.recordMs /= ROUNDS;
+	result.totalMs /= ROUNDS;
+	return result;
+}
+
+// Same rebinding pattern, but the buffer triple travels as device addresses in push constants
+static BenchmarkResult runBufferDeviceAddressMode(VkDevice device, VkCommandPool commandPool, VkCommandBuffer commandBuffer,
+	VkPipeline pipeline, VkPipelineLayout pipelineLayout, const std::vector<VkDeviceAddress>& inputs,
+	const std::vector<VkDeviceAddress>& outputs) {
+	BenchmarkResult result = {};
+	for (uint32_t round = 0; round < WARMUP_ROUNDS + ROUNDS; ++round) {
+		vkResetCommandPool(device, commandPool, 0);
+
+		auto start = std::chrono::steady_clock::now();
+		beginCommandBuffer(commandBuffer);
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+		for (uint32_t i = 0; i < DISPATCHES_PER_ROUND; ++i) {
+			VectorAddPushConstants pushConstants = {};
+			pushConstants.a = inputs[i % BUFFER_COUNT];
+			pushConstants.b = inputs[(i + 1) % BUFFER_COUNT];
+			pushConstants.result = outputs[i % BUFFER_COUNT];
+			pushConstants.count = VECTOR_SIZE;
+			recordDispatchWithPushConstants(commandBuffer, pipelineLayout, &pushConstants, sizeof(pushConstants), GROUP_COUNT, 1);
+			if (endsOutputBatch(i)) {
+				recordComputeBarrier(commandBuffer);
+			}
+		}
+		endCommandBuffer(commandBuffer);
+		auto recorded = std::chrono::steady_clock::now();
+
+		submitCommandBuffer(device, commandBuffer);
+		auto finished = std::chrono::steady_clock::now();
+
+		if (round < WARMUP_ROUNDS) {
+			continue;
+		}
+		result.recordMs += elapsedMs(start, recorded);
+		result.totalMs += elapsedMs(start, finished);
+	}
+	result.recordMs /= ROUNDS;
+	result.totalMs /= ROUNDS;
+	return result;
+}
+
+// Input k holds k + j, and output k is always written from inputs k and k + 1
+static float inputValue(uint32_t buffer, uint32_t index) {
+	return static_cast<float>(buffer + index);
+}
+
+static void clearOutputs(VkDevice device, const std::vector<VkDeviceMemory>& outputMemories) {
+	for (VkDeviceMemory outputMemory : outputMemories) {
+		initializeBufferData(device, outputMemory, VECTOR_SIZE, [](int) { return 0.0f; });
+	}
+}
+
+static bool verifyOutputs(VkDevice device, const std::vector<VkDeviceMemory>& outputMemories) {
+	for (uint32_t k = 0; k < BUFFER_COUNT; ++k) {
+		void* data;
+		vkMapMemory(device, outputMemories[k], 0, VECTOR_SIZE * sizeof(float), 0, &data);
+		const float* mappedData = static_cast<const float*>(data);
+		bool correct = true;
+		for (uint32_t j = 0; j < VECTOR_SIZE && correct; ++j) {
+			float expected = inputValue(k, j) + inputValue((k + 1) % BUFFER_COUNT, j);
+			if (mappedData[j] != expected) {
+				std::cout << "Mismatch in output " << k << " at " << j << ": got " << mappedData[j]
+					<< ", expected " << expected << std::endl;
+				correct = false;
+			}
+		}
+		vkUnmapMemory(device, outputMemories[k]);
+		if (!correct) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void printResult(const char* mode, const BenchmarkResult& result) {
+	std::cout << mode << ": record " << result.recordMs << " ms, record + execute " << result.totalMs << " ms"
+		<< " (" << DISPATCHES_PER_ROUND << " dispatches, average of " << ROUNDS << " rounds)" << std::endl;
+}
+
+int main()
+{
+	// No validation layer: it would dominate the timings and may not be installed
+	VkInstance instance = createInstance(false);
+	VkPhysicalDevice physicalDevice;
+	VkQueue graphicsQueue;
+	bool bufferDeviceAddressEnabled;
+	VkDevice device = createLogicalDevice(instance, physicalDevice, graphicsQueue, true, bufferDeviceAddressEnabled);
+
+	// Outputs are separate from inputs so values stay bounded across dispatches and rounds
+	std::vector<VkBuffer> inputs(BUFFER_COUNT), outputs(BUFFER_COUNT);
+	std::vector<VkDeviceMemory> inputMemories(BUFFER_COUNT), outputMemories(BUFFER_COUNT);
+	for (uint32_t i = 0; i < BUFFER_COUNT; ++i) {
+		createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), inputs[i], inputMemories[i], bufferDeviceAddressEnabled);
+		createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), outputs[i], outputMemories[i], bufferDeviceAddressEnabled);
+		initializeBufferData(device, inputMemories[i], VECTOR_SIZE, [i](int j) { return inputValue(i, j); });
+	}
+
+	VkCommandPool commandPool = createCommandPool(device);
+	VkCommandBuffer commandBuffer = createCommandBuffer(device, commandPool);
+
+	// Descriptor set mode
+	VkShaderModule computeShaderModule = createShaderModule(device, "./kernels/vector_add.comp.spv");
+	VkDescriptorSetLayout descriptorSetLayout = createDescriptorSetLayout(device);
+	VkPipelineLayout pipelineLayout = createPipelineLayout(device, descriptorSetLayout);
+	VkPipeline pipeline = createComputePipeline(device, computeShaderModule, pipelineLayout);
+	VkDescriptorPool descriptorPool = createDescriptorPool(device, DISPATCHES_PER_ROUND);
+
+	clearOutputs(device, outputMemories);
+	BenchmarkResult descriptorResult = runDescriptorMode(device, commandPool, commandBuffer, pipeline, pipelineLayout,
+		descriptorSetLayout, descriptorPool, inputs, outputs);
+	if (verifyOutputs(device, outputMemories)) {
+		printResult("Descriptor sets", descriptorResult);
+	}
+	else {
+		std::cout << "Descriptor sets: results incorrect, timings discarded" << std::endl;
+	}
+
+	// Buffer device address mode
+	if (bufferDeviceAddressEnabled) {
+		VkShaderModule bdaShaderModule = createShaderModule(device, "./kernels/vector_add_bda.comp.spv");
+		VkPipelineLayout bdaPipelineLayout = createPushConstantPipelineLayout(device, sizeof(VectorAddPushConstants));
+		VkPipeline bdaPipeline = createComputePipeline(device, bdaShaderModule, bdaPipelineLayout);
+
+		std::vector<VkDeviceAddress> inputAddresses(BUFFER_COUNT), outputAddresses(BUFFER_COUNT);
+		for (uint32_t i = 0; i < BUFFER_COUNT; ++i) {
+			inputAddresses[i] = getBufferDeviceAddress(device, inputs[i]);
+			outputAddresses[i] = getBufferDeviceAddress(device, outputs[i]);
+		}
+
+		// Cleared so stale descriptor-mode results can't pass verification
+		clearOutputs(device, outputMemories);
+		BenchmarkResult bdaResult = runBufferDeviceAddressMode(device, commandPool, commandBuffer,
+			bdaPipeline, bdaPipelineLayout, inputAddresses, outputAddresses);
+		if (verifyOutputs(device, outputMemories)) {
+			printResult("Buffer device address", bdaResult);
+		}
+		else {
+			std::cout << "Buffer device address: results incorrect, timings discarded" << std::endl;
+		}
+
+		vkDestroyPipeline(device, bdaPipeline, nullptr);
+		vkDestroyPipelineLayout(device, bdaPipelineLayout, nullptr);
+		vkDestroyShaderModule(device, bdaShaderModule, nullptr);
+	}
+	else {
+		std::cout << "Buffer device address: skipped, not supported on this device" << std::endl;
+	}
+
+	std::vector<VkBuffer> buffers = inputs;
+	buffers.insert(buffers.end(), outputs.begin(), outputs.end());
+	std::vector<VkDeviceMemory> bufferMemories = inputMemories;
+	bufferMemories.insert(bufferMemories.end(), outputMemories.begin(), outputMemories.end());
+	cleanup(device, instance, pipeline, pipelineLayout, computeShaderModule, descriptorSetLayout, descriptorPool, commandPool, buffers, bufferMemories);
+	return 0;
+}
@@ -6,38 +6,74 @@
 #include "vk_command.hpp"
 #include "vk_utils.hpp"
 #include <iostream>
+#include <cstring>
 
 const uint32_t WIDTH = 1024;
 const uint32_t HEIGHT = 1;
 const uint32_t VECTOR_SIZE = WIDTH * HEIGHT;
+// Both kernels use local_size_x = 256, so dispatch one workgroup per 256 elements
+const uint32_t WORKGROUP_SIZE = 256;
+const uint32_t GROUP_COUNT = (VECTOR_SIZE + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
 
-int main()
+int main(int argc, char** argv)
 {
+	// Descriptor sets by default; pass --device-address to use buffer device addresses when available
+	bool requestBufferDeviceAddress = argc > 1 && std::strcmp(argv[1], "--device-address") == 0;
+
 	VkInstance instance = createInstance();
 	VkPhysicalDevice physicalDevice;
 	VkQueue graphicsQueue;
-	VkDevice device = createLogicalDevice(instance, physicalDevice, graphicsQueue);
+	bool useBufferDeviceAddress;
+	VkDevice device = createLogicalDevice(instance, physicalDevice, graphicsQueue, requestBufferDeviceAddress, useBufferDeviceAddress);
+	std::cout << "Binding mode: " << (useBufferDeviceAddress ? "buffer device address" : "descriptor sets") << std::endl;
 
 	VkBuffer bufferA, bufferB, bufferResult;
 	VkDeviceMemory bufferMemoryA, bufferMemoryB, bufferMemoryResult;
-	createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), bufferA, bufferMemoryA);
-	createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), bufferB, bufferMemoryB);
-	createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), bufferResult, bufferMemoryResult);
+	createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), bufferA, bufferMemoryA, useBufferDeviceAddress);
+	createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), bufferB, bufferMemoryB, useBufferDeviceAddress);
+	createBuffer(device, physicalDevice, VECTOR_SIZE * sizeof(float), bufferResult, bufferMemoryResult, useBufferDeviceAddress);
 
 	initializeBufferData(device, bufferMemoryA, VECTOR_SIZE, [](int i) { return static_cast<float>(i); });
 	initializeBufferData(device, bufferMemoryB, VECTOR_SIZE, [](int i) { return static_cast<float>(2 * i); });
 
-	VkShaderModule computeShaderModule = createShaderModule(device, "./kernels/vector_add.comp.spv");
-	VkDescriptorSetLayout descriptorSetLayout = createDescriptorSetLayout(device);
-	VkPipelineLayout pipelineLayout = createPipelineLayout(device, descriptorSetLayout);
-	VkPipeline pipeline = createComputePipeline(device, computeShaderModule, pipelineLayout);
+	VkShaderModule computeShaderModule;
+	VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+	VkPipelineLayout pipelineLayout;
+	VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+	VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+	VectorAddPushConstants pushConstants = {};
+
+	if (useBufferDeviceAddress)
+	{
+		computeShaderModule = createShaderModule(device, "./kernels/vector_add_bda.comp.spv");
+		pipelineLayout = createPushConstantPipelineLayout(device, sizeof(VectorAddPushConstants));
 
-	VkDescriptorPool descriptorPool = createDescriptorPool(device);
-	VkDescriptorSet descriptorSet = createDescriptorSet(device, descriptorPool, descriptorSetLayout, bufferA, bufferB, bufferResult, VECTOR_SIZE * sizeof(float));
+		pushConstants.a = getBufferDeviceAddress(device, bufferA);
+		pushConstants.b = getBufferDeviceAddress(device, bufferB);
+		pushConstants.result = getBufferDeviceAddress(device, bufferResult);
+		pushConstants.count = VECTOR_SIZE;
+	}
+	else
+	{
+		computeShaderModule = createShaderModule(device, "./kernels/vector_add.comp.spv");
+		descriptorSetLayout = createDescriptorSetLayout(device);
+		pipelineLayout = createPipelineLayout(device, descriptorSetLayout);
+
+		descriptorPool = createDescriptorPool(device);
+		descriptorSet = createDescriptorSet(device, descriptorPool, descriptorSetLayout, bufferA, bufferB, bufferResult, VECTOR_SIZE * sizeof(float));
+	}
+	VkPipeline pipeline = createComputePipeline(device, computeShaderModule, pipelineLayout);
 
 	VkCommandPool commandPool = createCommandPool(device);
 	VkCommandBuffer commandBuffer = createCommandBuffer(device, commandPool);
-	recordCommandBuffer(commandBuffer, pipeline, pipelineLayout, descriptorSet, WIDTH, HEIGHT);
+	if (useBufferDeviceAddress)
+	{
+		recordCommandBufferWithPushConstants(commandBuffer, pipeline, pipelineLayout, &pushConstants, sizeof(pushConstants), GROUP_COUNT, 1);
+	}
+	else
+	{
+		recordCommandBuffer(commandBuffer, pipeline, pipelineLayout, descriptorSet, GROUP_COUNT, 1);
+	}
 
 	submitCommandBuffer(device, commandBuffer);
 
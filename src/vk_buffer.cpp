@@ -3,11 +3,15 @@
 #include <stdexcept>
 #include <iostream>
 
-void createBuffer(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize size, VkBuffer& buffer, VkDeviceMemory& bufferMemory) {
+void createBuffer(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize size, VkBuffer& buffer, VkDeviceMemory& bufferMemory,
+	bool enableDeviceAddress) {
 	VkBufferCreateInfo bufferInfo = {};
 	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 	bufferInfo.size = size;
 	bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+	if (enableDeviceAddress) {
+		bufferInfo.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR;
+	}
 
 	if (vkCreateBuffer(device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
 		throw std::runtime_error("failed to create buffer!");
@@ -22,6 +26,14 @@ void createBuffer(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize
 	allocInfo.memoryTypeIndex = findMemoryType(physicalDevice, memRequirements.memoryTypeBits,
 		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
+	// Memory backing a device-address buffer must be allocated with the device address flag
+	VkMemoryAllocateFlagsInfo allocFlagsInfo = {};
+	allocFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+	allocFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR;
+	if (enableDeviceAddress) {
+		allocInfo.pNext = &allocFlagsInfo;
+	}
+
 	if (vkAllocateMemory(device, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
 		throw std::runtime_error("failed to allocate buffer memory!");
 	}
@@ -29,6 +41,29 @@ void createBuffer(VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize
 	vkBindBufferMemory(device, buffer, bufferMemory, 0);
 }
 
+// Extension entry point, resolved once through the device by loadBufferDeviceAddressFunction
+static PFN_vkGetBufferDeviceAddressKHR getBufferDeviceAddressKHR = nullptr;
+
+void loadBufferDeviceAddressFunction(VkDevice device) {
+	getBufferDeviceAddressKHR = reinterpret_cast<PFN_vkGetBufferDeviceAddressKHR>(
+		vkGetDeviceProcAddr(device, "vkGetBufferDeviceAddressKHR"));
+	if (getBufferDeviceAddressKHR == nullptr) {
+		throw std::runtime_error("failed to load vkGetBufferDeviceAddressKHR!");
+	}
+}
+
+VkDeviceAddress getBufferDeviceAddress(VkDevice device, VkBuffer buffer) {
+	if (getBufferDeviceAddressKHR == nullptr) {
+		throw std::runtime_error("buffer device address is not enabled on this device!");
+	}
+
+	VkBufferDeviceAddressInfoKHR addressInfo = {};
+	addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+	addressInfo.buffer = buffer;
+
+	return getBufferDeviceAddressKHR(device, &addressInfo);
+}
+
 void initializeBufferData(VkDevice device, VkDeviceMemory bufferMemory, uint32_t vectorSize, std::function<float(int)> initFunction) {
 	void* data;
 	vkMapMemory(device, bufferMemory, 0, vectorSize * sizeof(float), 0, &data);
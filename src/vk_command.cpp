@@ -28,24 +28,50 @@ VkCommandBuffer createCommandBuffer(VkDevice device, VkCommandPool commandPool)
 	return commandBuffer;
 }
 
-void recordCommandBuffer(VkCommandBuffer commandBuffer, VkPipeline pipeline, VkPipelineLayout pipelineLayout,
-	VkDescriptorSet descriptorSet, uint32_t width, uint32_t height) {
+void beginCommandBuffer(VkCommandBuffer commandBuffer) {
 	VkCommandBufferBeginInfo beginInfo = {};
 	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 
 	if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
 		throw std::runtime_error("failed to begin recording command buffer!");
 	}
+}
 
-	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
-	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
-	vkCmdDispatch(commandBuffer, width, height, 1);
-
+void endCommandBuffer(VkCommandBuffer commandBuffer) {
 	if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
 		throw std::runtime_error("failed to record command buffer!");
 	}
 }
 
+void recordDispatch(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout, VkDescriptorSet descriptorSet,
+	uint32_t width, uint32_t height) {
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+	vkCmdDispatch(commandBuffer, width, height, 1);
+}
+
+// Buffers are passed as device addresses inside the push constants, so no descriptor set is bound
+void recordDispatchWithPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout,
+	const void* pushConstants, uint32_t pushConstantSize, uint32_t width, uint32_t height) {
+	vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, pushConstantSize, pushConstants);
+	vkCmdDispatch(commandBuffer, width, height, 1);
+}
+
+void recordCommandBuffer(VkCommandBuffer commandBuffer, VkPipeline pipeline, VkPipelineLayout pipelineLayout,
+	VkDescriptorSet descriptorSet, uint32_t width, uint32_t height) {
+	beginCommandBuffer(commandBuffer);
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+	recordDispatch(commandBuffer, pipelineLayout, descriptorSet, width, height);
+	endCommandBuffer(commandBuffer);
+}
+
+void recordCommandBufferWithPushConstants(VkCommandBuffer commandBuffer, VkPipeline pipeline, VkPipelineLayout pipelineLayout,
+	const void* pushConstants, uint32_t pushConstantSize, uint32_t width, uint32_t height) {
+	beginCommandBuffer(commandBuffer);
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+	recordDispatchWithPushConstants(commandBuffer, pipelineLayout, pushConstants, pushConstantSize, width, height);
+	endCommandBuffer(commandBuffer);
+}
+
 void submitCommandBuffer(VkDevice device, VkCommandBuffer commandBuffer) {
 	VkSubmitInfo submitInfo = {};
 	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
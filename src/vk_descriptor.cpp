@@ -2,16 +2,16 @@
 #include "vk_utils.hpp"
 #include <stdexcept>
 
-VkDescriptorPool createDescriptorPool(VkDevice device) {
+VkDescriptorPool createDescriptorPool(VkDevice device, uint32_t maxSets) {
 	VkDescriptorPoolSize poolSize = {};
 	poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-	poolSize.descriptorCount = 3;
+	poolSize.descriptorCount = 3 * maxSets;
 
 	VkDescriptorPoolCreateInfo createInfo = {};
 	createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
 	createInfo.poolSizeCount = 1;
 	createInfo.pPoolSizes = &poolSize;
-	createInfo.maxSets = 1;
+	createInfo.maxSets = maxSets;
 
 	VkDescriptorPool descriptorPool;
 	if (vkCreateDescriptorPool(device, &createInfo, nullptr, &descriptorPool) != VK_SUCCESS) {
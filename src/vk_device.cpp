@@ -1,9 +1,47 @@
 #include "vk_device.hpp"
+#include "vk_buffer.hpp"
+#include "vk_instance.hpp"
 #include "vk_utils.hpp"
 #include <iostream>
 #include <stdexcept>
 
-VkDevice createLogicalDevice(VkInstance instance, VkPhysicalDevice& physicalDevice, VkQueue& graphicsQueue)
+static bool isBufferDeviceAddressSupported(VkInstance instance, VkPhysicalDevice physicalDevice)
+{
+	// vkGetPhysicalDeviceFeatures2 and device-address memory allocation are core in Vulkan 1.1,
+	// so both the instance (see createInstance) and the device have to be at least 1.1
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+	if (getInstanceApiVersion() < VK_API_VERSION_1_1 || properties.apiVersion < VK_API_VERSION_1_1)
+	{
+		return false;
+	}
+
+	if (!isDeviceExtensionSupported(physicalDevice, VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME))
+	{
+		return false;
+	}
+
+	VkPhysicalDeviceBufferDeviceAddressFeaturesKHR bufferDeviceAddressFeatures = {};
+	bufferDeviceAddressFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_KHR;
+
+	// Loaded at runtime so the program still starts against a 1.0 loader
+	auto getFeatures2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2>(
+		vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures2"));
+	if (getFeatures2 == nullptr)
+	{
+		return false;
+	}
+
+	VkPhysicalDeviceFeatures2 features2 = {};
+	features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+	features2.pNext = &bufferDeviceAddressFeatures;
+	getFeatures2(physicalDevice, &features2);
+
+	return bufferDeviceAddressFeatures.bufferDeviceAddress == VK_TRUE;
+}
+
+VkDevice createLogicalDevice(VkInstance instance, VkPhysicalDevice& physicalDevice, VkQueue& graphicsQueue,
+	bool requestBufferDeviceAddress, bool& bufferDeviceAddressEnabled)
 {
 	uint32_t deviceCount = 0;
 	vkEnumeratePhysicalDevices(instance, &deviceCount, nullptr);
@@ -48,7 +86,21 @@ VkDevice createLogicalDevice(VkInstance instance, VkPhysicalDevice& physicalDevi
 	deviceCreateInfo.queueCreateInfoCount = 1;
 	deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
 
-	std::vector<const char*> deviceExtensions = getDeviceExtensions();
+	bufferDeviceAddressEnabled = requestBufferDeviceAddress && isBufferDeviceAddressSupported(instance, physicalDevice);
+	if (requestBufferDeviceAddress && !bufferDeviceAddressEnabled)
+	{
+		std::cout << "Buffer device address not supported, falling back to descriptor sets" << std::endl;
+	}
+
+	VkPhysicalDeviceBufferDeviceAddressFeaturesKHR bufferDeviceAddressFeatures = {};
+	bufferDeviceAddressFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_KHR;
+	bufferDeviceAddressFeatures.bufferDeviceAddress = VK_TRUE;
+	if (bufferDeviceAddressEnabled)
+	{
+		deviceCreateInfo.pNext = &bufferDeviceAddressFeatures;
+	}
+
+	std::vector<const char*> deviceExtensions = getDeviceExtensions(bufferDeviceAddressEnabled);
 	checkDeviceExtensions(physicalDevice, deviceExtensions);
 
 	deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
@@ -62,6 +114,10 @@ VkDevice createLogicalDevice(VkInstance instance, VkPhysicalDevice& physicalDevi
 		throw std::runtime_error("failed to create logical device!");
 	}
 	vkGetDeviceQueue(device, graphicsFamily, 0, &graphicsQueue);
+	if (bufferDeviceAddressEnabled)
+	{
+		loadBufferDeviceAddressFunction(device);
+	}
 	std::cout << "Logical device created successfully!" << std::endl;
 	return device;
 }
@@ -3,7 +3,20 @@
 #include <iostream>
 #include <stdexcept>
 
-VkInstance createInstance()
+// vkEnumerateInstanceVersion only exists on 1.1+ loaders, so a missing entry point means 1.0
+uint32_t getInstanceApiVersion()
+{
+	auto enumerateInstanceVersion = reinterpret_cast<PFN_vkEnumerateInstanceVersion>(
+		vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceVersion"));
+	uint32_t apiVersion = VK_API_VERSION_1_0;
+	if (enumerateInstanceVersion != nullptr && enumerateInstanceVersion(&apiVersion) != VK_SUCCESS)
+	{
+		apiVersion = VK_API_VERSION_1_0;
+	}
+	return apiVersion;
+}
+
+VkInstance createInstance(bool enableValidation)
 {
 	VkInstance instance;
 	VkApplicationInfo appInfo = {};
@@ -12,7 +25,8 @@ VkInstance createInstance()
 	appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
 	appInfo.pEngineName = "Vulkan Engine";
 	appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-	appInfo.apiVersion = VK_API_VERSION_1_0;
+	// Buffer device address mode needs 1.1, but a 1.0 driver may reject it, so only ask when available
+	appInfo.apiVersion = getInstanceApiVersion() >= VK_API_VERSION_1_1 ? VK_API_VERSION_1_1 : VK_API_VERSION_1_0;
 
 	VkInstanceCreateInfo createInfo = {};
 	createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -26,7 +40,10 @@ VkInstance createInstance()
 
 	// Validation layers for debugging
 	std::vector<const char*> validationLayers;
-	validationLayers.push_back("VK_LAYER_KHRONOS_validation");
+	if (enableValidation)
+	{
+		validationLayers.push_back("VK_LAYER_KHRONOS_validation");
+	}
 	createInfo.enabledLayerCount = static_cast<uint32_t>(validationLayers.size());
 	createInfo.ppEnabledLayerNames = validationLayers.data();
 
@@ -54,6 +54,28 @@ VkPipelineLayout createPipelineLayout(VkDevice device, VkDescriptorSetLayout des
 	return pipelineLayout;
 }
 
+// Descriptor-free layout: kernels receive buffer device addresses through push constants
+VkPipelineLayout createPushConstantPipelineLayout(VkDevice device, uint32_t pushConstantSize) {
+	VkPushConstantRange pushConstantRange = {};
+	pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+	pushConstantRange.offset = 0;
+	pushConstantRange.size = pushConstantSize;
+
+	VkPipelineLayoutCreateInfo createInfo = {};
+	createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	createInfo.setLayoutCount = 0;
+	createInfo.pSetLayouts = nullptr;
+	createInfo.pushConstantRangeCount = 1;
+	createInfo.pPushConstantRanges = &pushConstantRange;
+
+	VkPipelineLayout pipelineLayout;
+	if (vkCreatePipelineLayout(device, &createInfo, nullptr, &pipelineLayout) != VK_SUCCESS) {
+		throw std::runtime_error("failed to create pipeline layout!");
+	}
+
+	return pipelineLayout;
+}
+
 VkPipeline createComputePipeline(VkDevice device, VkShaderModule shaderModule, VkPipelineLayout pipelineLayout) {
 	VkComputePipelineCreateInfo createInfo = {};
 	createInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
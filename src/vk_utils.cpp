@@ -1,6 +1,7 @@
 #include "vk_utils.hpp"
 #include <iostream>
 #include <fstream>
+#include <cstring>
 
 std::vector<char> readFile(const std::string& filename)
 {
@@ -28,7 +29,7 @@ std::vector<const char*> getInstanceExtensions()
 	return extensions;
 }
 
-std::vector<const char*> getDeviceExtensions()
+std::vector<const char*> getDeviceExtensions(bool enableBufferDeviceAddress)
 {
 	std::vector<const char*> extensions;
 
@@ -36,6 +37,12 @@ std::vector<const char*> getDeviceExtensions()
 	extensions.push_back("VK_KHR_portability_subset"); // Required for MoltenVK
 #endif
 
+	if (enableBufferDeviceAddress)
+	{
+		// Lets kernels take raw buffer pointers through push constants instead of descriptor sets
+		extensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+	}
+
 	return extensions;
 }
 
@@ -101,6 +108,23 @@ void checkDeviceExtensions(VkPhysicalDevice device, const std::vector<const char
 	}
 }
 
+bool isDeviceExtensionSupported(VkPhysicalDevice device, const char* extensionName)
+{
+	uint32_t extensionCount = 0;
+	vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
+	std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+	vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
+
+	for (const auto& ext : availableExtensions)
+	{
+		if (std::strcmp(extensionName, ext.extensionName) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 uint32_t findMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties)
 {
 	VkPhysicalDeviceMemoryProperties memProperties;